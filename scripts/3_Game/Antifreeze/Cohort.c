@@ -0,0 +1,76 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/antifreeze
+*/
+
+#ifdef SERVER
+/**
+    \brief Named experiment cohort: a share of infected with its own parameter overrides.
+
+    Override fields use -1 as "inherit from the base config".
+    Toggles accept -1 (inherit), 0 (off) or 1 (on).
+*/
+class Antifreeze_Cohort
+{
+	string name = "cohort"; //!< Cohort name used in metrics report
+	float share = 0.0; //!< 0.0..1.0: fraction of infected assigned to this cohort
+
+	// * Toggle overrides
+	int enableAntifreeze = -1; //!< 0 makes this cohort a vanilla control group
+	int enableFreezeUnreachableByHeight = -1;
+	int enableChaseTokenBudget = -1;
+	int enableLocalDensityCulling = -1;
+	int enableFollowerThrottling = -1;
+
+	// * Tuning overrides
+	float unreachablePersistSeconds = -1;
+	float frozenProbeBaseIntervalSeconds = -1;
+	float throttleBaseIntervalSeconds = -1;
+	float activeRingRadiusMeters = -1;
+	int densityMaxNeighbors = -1;
+	float chaseTokenTTLSeconds = -1;
+	float chaseKeepBaseProbability = -1;
+	float followerSleepSeconds = -1;
+	float followerActiveSeconds = -1;
+
+	/**
+	    \brief Apply non-inherited overrides on top of a base config copy.
+	    \param cfg Config copy owned by this cohort (normalized by caller afterwards).
+	*/
+	void Apply(Antifreeze_Config cfg)
+	{
+		// Toggles
+		if (enableAntifreeze >= 0)
+			cfg.enableAntifreeze = enableAntifreeze > 0;
+		if (enableFreezeUnreachableByHeight >= 0)
+			cfg.enableFreezeUnreachableByHeight = enableFreezeUnreachableByHeight > 0;
+		if (enableChaseTokenBudget >= 0)
+			cfg.enableChaseTokenBudget = enableChaseTokenBudget > 0;
+		if (enableLocalDensityCulling >= 0)
+			cfg.enableLocalDensityCulling = enableLocalDensityCulling > 0;
+		if (enableFollowerThrottling >= 0)
+			cfg.enableFollowerThrottling = enableFollowerThrottling > 0;
+
+		// Tuning
+		if (unreachablePersistSeconds >= 0)
+			cfg.unreachablePersistSeconds = unreachablePersistSeconds;
+		if (frozenProbeBaseIntervalSeconds >= 0)
+			cfg.frozenProbeBaseIntervalSeconds = frozenProbeBaseIntervalSeconds;
+		if (throttleBaseIntervalSeconds >= 0)
+			cfg.throttleBaseIntervalSeconds = throttleBaseIntervalSeconds;
+		if (activeRingRadiusMeters >= 0)
+			cfg.activeRingRadiusMeters = activeRingRadiusMeters;
+		if (densityMaxNeighbors >= 0)
+			cfg.densityMaxNeighbors = densityMaxNeighbors;
+		if (chaseTokenTTLSeconds >= 0)
+			cfg.chaseTokenTTLSeconds = chaseTokenTTLSeconds;
+		if (chaseKeepBaseProbability >= 0)
+			cfg.chaseKeepBaseProbability = chaseKeepBaseProbability;
+		if (followerSleepSeconds >= 0)
+			cfg.followerSleepSeconds = followerSleepSeconds;
+		if (followerActiveSeconds >= 0)
+			cfg.followerActiveSeconds = followerActiveSeconds;
+	}
+}
+#endif
@@ -0,0 +1,127 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/antifreeze
+*/
+
+#ifdef SERVER
+/**
+    \brief Cumulative counters for a single experiment cohort.
+*/
+class Antifreeze_CohortStats
+{
+	string name; //!< Cohort name
+	int actors; //!< Infected that ever joined this cohort, each counted once, never decremented
+	int nativeTicks; //!< Native CommandHandler ticks executed
+	int freezes; //!< Times native AI was frozen
+	int reached; //!< CHASE -> FIGHT transitions
+	float reachTimeTotalSeconds; //!< Sum of CHASE durations that ended in FIGHT
+	float reachTimeAvgSeconds; //!< reachTimeTotalSeconds / reached, refreshed on flush
+	float damageDealt; //!< Health damage dealt to players
+
+	void Antifreeze_CohortStats(string cohortName)
+	{
+		name = cohortName;
+	}
+
+	/**
+	    \brief Record a CHASE that ended with the actor reaching FIGHT.
+	    \param seconds Time spent in CHASE before reaching the target.
+	*/
+	void AddReach(float seconds)
+	{
+		reached++;
+		reachTimeTotalSeconds += seconds;
+	}
+}
+
+/**
+    \brief Report layout written to $profile.
+*/
+class Antifreeze_CohortReport
+{
+	float uptimeSeconds; //!< Seconds since metrics collection started
+	ref array<ref Antifreeze_CohortStats> cohorts = new array<ref Antifreeze_CohortStats>();
+}
+
+/**
+    \brief Per-cohort metrics registry, periodically flushed to $profile.
+
+    Stats are keyed by cohort name and survive config hot reload,
+    so counters keep accumulating while cohort overrides are tuned.
+*/
+class Antifreeze_CohortMetrics
+{
+	// * Const
+	protected static const string REPORT_FILE = "$profile:antifreeze_cohorts.json";
+
+	// * Singleton
+	ref protected static Antifreeze_CohortMetrics s_Instance;
+
+	ref protected map<string, ref Antifreeze_CohortStats> m_Stats = new map<string, ref Antifreeze_CohortStats>();
+	ref protected Antifreeze_CohortReport m_Report = new Antifreeze_CohortReport();
+	protected float m_FlushAccum;
+
+	/**
+	    \brief Get singleton instance.
+	*/
+	static Antifreeze_CohortMetrics Get()
+	{
+		if (!s_Instance)
+			s_Instance = new Antifreeze_CohortMetrics();
+
+		return s_Instance;
+	}
+
+	/**
+	    \brief Get or create stats for a cohort.
+	    \param name Cohort name.
+	    \return Stats bucket owned by the registry.
+	*/
+	Antifreeze_CohortStats GetStats(string name)
+	{
+		Antifreeze_CohortStats stats = m_Stats.Get(name);
+		if (!stats) {
+			stats = new Antifreeze_CohortStats(name);
+			m_Stats.Insert(name, stats);
+			m_Report.cohorts.Insert(stats);
+		}
+
+		return stats;
+	}
+
+	/**
+	    \brief Advance uptime and flush the report on the configured interval.
+	    \param dt Frame delta time.
+	*/
+	void Update(float dt)
+	{
+		m_Report.uptimeSeconds += dt;
+		m_FlushAccum += dt;
+
+		if (m_FlushAccum < Antifreeze_Config.Get().cohortStatsIntervalSeconds)
+			return;
+
+		m_FlushAccum = 0.0;
+		Flush();
+	}
+
+	/**
+	    \brief Write current counters to $profile.
+	*/
+	void Flush()
+	{
+		if (m_Report.cohorts.Count() == 0)
+			return;
+
+		foreach (Antifreeze_CohortStats stats : m_Report.cohorts) {
+			if (stats.reached > 0)
+				stats.reachTimeAvgSeconds = stats.reachTimeTotalSeconds / stats.reached;
+		}
+
+		string error;
+		if (!JsonFileLoader<Antifreeze_CohortReport>.SaveFile(REPORT_FILE, m_Report, error))
+			ErrorEx(error);
+	}
+}
+#endif
@@ -12,24 +12,28 @@ class Antifreeze_Config
 {
 	// * Const
 	protected static const string CONFIG_FILE = "$profile:antifreeze.json";
-	protected static const int CONFIG_VERSION = 2;
+	protected static const int CONFIG_VERSION = 5;
 	protected static const int DEFAULT_CLEANUP_LIFETIME_DEAD_INFECTED = 330;
 
 	// * Singleton
 	ref protected static Antifreeze_Config s_Instance;
 	protected static bool s_Loaded;
+	protected static int s_Generation; //!< Bumped on every load so actors re-resolve cohorts
 
 	// * Feature toggles
 	bool enableAntifreeze = true; //!< Master switch for the whole module
 	bool enableFreezeUnreachableByHeight = true; //!< Freeze when target is near but vertically unreachable
 	bool enableChaseTokenBudget = true; //!< Rotate far CHASE actors via short-lived tokens
 	bool enableLocalDensityCulling = true; //!< Freeze extra actors if too many neighbors nearby
+	bool enableFollowerThrottling = true; //!< Tick CHASE followers trailing a same-target leader at reduced cadence
 	bool enableRandomJitter = true; //!< Add jitter to probe/TTL timings to avoid spikes
 	bool enableCheapAttackProbe = false; //!< Use single CanAttackToPosition probe as cheap reachability check
 	bool enableFrozenAgingTicks = true; //!< While frozen, forward rare super() ticks to age native timers
 	bool enableRandomPerZombieOptOut = false; //!< Some zombies run pure vanilla logic
 	bool enableForceCleanupBodies = true; //!< Allow delete dead zombie bodies near player
 	bool enableHotConfigReload = false; //!< Allow to use afzr command for reload config
+	bool enableCohorts = false; //!< Split infected into deterministic experiment cohorts
+	bool enableSpikeForensics = false; //!< Snapshot infected population on slow server frames
 
 	// * Core timing & jitter
 	float unreachablePersistSeconds = 0.6; //!< Condition persistence before freezing AI
@@ -58,6 +62,12 @@ class Antifreeze_Config
 	float chaseKeepMinProbability = 0.04; //!< Lower clamp for the probability
 	float chaseKeepMaxProbability = 0.55; //!< Upper clamp for the probability
 
+	// * Follower throttling
+	float followerLinkRadiusMeters = 3.0; //!< Max distance to a same-target leader closer to the target
+	float followerSleepSeconds = 0.6; //!< Extra sleep added to the throttle interval for followers
+	float followerActiveSeconds = 0.2; //!< Max far CHASE token lifetime for followers
+	float followerRescanSeconds = 1.0; //!< Interval between leader searches for leaderless actors
+
 	// * Stimulus windows
 	float wakeGraceSeconds = 3.0; //!< No-freeze window after a wake (hit/contact)
 	float wakeCooldownSeconds = 0.30; //!< Min time between consecutive wake triggers
@@ -65,6 +75,22 @@ class Antifreeze_Config
 	// * Random opt-out
 	float randomOptOutRatio = 0.0; //!< 0.0..0.9: fraction of zombies running vanilla only
 
+	// * Experiment cohorts
+	int cohortSeed = 0; //!< Salt for cohort assignment; change to reshuffle actors
+	float cohortStatsIntervalSeconds = 60.0; //!< Seconds between cohort report writes
+	ref array<ref Antifreeze_Cohort> cohorts = new array<ref Antifreeze_Cohort>(); //!< Cohort definitions
+	[NonSerialized()]
+	ref array<ref Antifreeze_Config> m_CohortConfigs = new array<ref Antifreeze_Config>(); //!< Resolved per-cohort configs
+	[NonSerialized()]
+	ref array<int> m_CohortBounds = new array<int>(); //!< Cumulative per-mille share upper bounds
+
+	// * Frame spike forensics
+	float spikeFrameThresholdMs = 150.0; //!< Frame time that triggers a spike report
+	float spikeCooldownSeconds = 60.0; //!< Min time between spike reports (also startup warmup)
+	int spikeMaxReports = 20; //!< Reports kept in the spike log (oldest dropped)
+	int spikeMaxTargets = 16; //!< Targets per report, busiest first
+	int spikeMaxPositionsPerTarget = 24; //!< Pursuer positions recorded per target
+
 	// * Bodies cleanup
 	int cleanupBodiesTTL = -1; //!< Seconds before force delete body, value < 0 for use CE settings
 	[NonSerialized()]
@@ -87,6 +113,14 @@ class Antifreeze_Config
 		return s_Instance;
 	}
 
+	/**
+	    \brief Config load counter, lets cached per-actor state detect hot reloads.
+	*/
+	static int GetGeneration()
+	{
+		return s_Generation;
+	}
+
 	/**
 	    \brief Drop instance and force reload on next Get().
 	*/
@@ -131,6 +165,7 @@ class Antifreeze_Config
 				ErrorEx("Saved upgraded AntifreeZe config file: " + CONFIG_FILE, ErrorExSeverity.INFO);
 			}
 
+			BuildCohorts();
 			SetLoaded();
 			return;
 		}
@@ -154,6 +189,7 @@ class Antifreeze_Config
 	protected void SetLoaded()
 	{
 		s_Loaded = true;
+		s_Generation++;
 		ErrorEx("AntifreeZe loaded", ErrorExSeverity.INFO);
 	}
 
@@ -188,6 +224,24 @@ class Antifreeze_Config
 		chaseKeepMinProbability = Math.Clamp(chaseKeepMinProbability, 0.00, 1.0);
 		chaseKeepMaxProbability = Math.Clamp(chaseKeepMaxProbability, 0.00, 1.0);
 
+		// Follower throttling
+		followerLinkRadiusMeters = Math.Clamp(followerLinkRadiusMeters, 0.5, 10.0);
+		followerSleepSeconds = Math.Clamp(followerSleepSeconds, 0.05, 5.0);
+		followerActiveSeconds = Math.Clamp(followerActiveSeconds, 0.05, 5.0);
+		followerRescanSeconds = Math.Clamp(followerRescanSeconds, 0.10, 10.0);
+
+		// Experiment cohorts
+		cohortStatsIntervalSeconds = Math.Clamp(cohortStatsIntervalSeconds, 5.0, 3600.0);
+		if (!cohorts)
+			cohorts = new array<ref Antifreeze_Cohort>();
+
+		// Frame spike forensics
+		spikeFrameThresholdMs = Math.Clamp(spikeFrameThresholdMs, 20.0, 5000.0);
+		spikeCooldownSeconds = Math.Clamp(spikeCooldownSeconds, 5.0, 3600.0);
+		spikeMaxReports = Math.Clamp(spikeMaxReports, 1, 100);
+		spikeMaxTargets = Math.Clamp(spikeMaxTargets, 1, 64);
+		spikeMaxPositionsPerTarget = Math.Clamp(spikeMaxPositionsPerTarget, 0, 128);
+
 		// Stimulus windows
 		wakeGraceSeconds = Math.Clamp(wakeGraceSeconds, 0.10, 10.0);
 		wakeCooldownSeconds = Math.Clamp(wakeCooldownSeconds, 0.10, 10.0);
@@ -202,6 +256,102 @@ class Antifreeze_Config
 			cleanupBodiesTTL = Math.Clamp(cleanupBodiesTTL, Math.Min(5, ceMaxTTL), ceMaxTTL);
 	}
 
+	/**
+	    \brief Resolve cohort configs and share bounds from cohort definitions.
+
+	    Each cohort gets its own normalized copy of this config with overrides applied.
+	    Shares are consumed in order; whatever exceeds 100% in total is dropped.
+	*/
+	protected void BuildCohorts()
+	{
+		m_CohortConfigs.Clear();
+		m_CohortBounds.Clear();
+
+		if (!enableCohorts || cohorts.Count() == 0)
+			return;
+
+		JsonSerializer js = new JsonSerializer();
+		string data;
+		string error;
+		if (!js.WriteToString(this, false, data)) {
+			ErrorEx("AntifreeZe cohorts disabled: failed to copy base config");
+			return;
+		}
+
+		int bound = 0;
+		foreach (Antifreeze_Cohort cohort : cohorts) {
+			Antifreeze_Config cfg = new Antifreeze_Config();
+			if (!js.ReadFromString(cfg, data, error)) {
+				ErrorEx(error);
+				m_CohortConfigs.Clear();
+				m_CohortBounds.Clear();
+				return;
+			}
+
+			cfg.cohorts = null;
+			cfg.ceMaxTTL = ceMaxTTL;
+			cohort.Apply(cfg);
+			cfg.Normalize();
+
+			cohort.share = Math.Clamp(cohort.share, 0.0, 1.0);
+			bound += Math.Round(cohort.share * 1000);
+			if (bound > 1000)
+				bound = 1000;
+
+			m_CohortConfigs.Insert(cfg);
+			m_CohortBounds.Insert(bound);
+		}
+	}
+
+	/**
+	    \brief Deterministically map an entity id to a cohort.
+	    \param entityId Stable entity id.
+	    \return Cohort index, or -1 if cohorts are off or the id falls outside all shares.
+	*/
+	int GetCohortIndex(int entityId)
+	{
+		if (m_CohortBounds.Count() == 0)
+			return -1;
+
+		// xorshift-multiply finalizer; masked shifts emulate logical >> on signed int
+		int h = entityId + cohortSeed * 0x9E3779B;
+		h = (((h >> 16) & 0xFFFF) ^ h) * 0x45D9F3B;
+		h = (((h >> 16) & 0xFFFF) ^ h) * 0x45D9F3B;
+		h = ((h >> 16) & 0xFFFF) ^ h;
+
+		// 31-bit value keeps per-mille bias below 1e-6
+		int bucket = (h & 0x7FFFFFFF) % 1000;
+
+		for (int i = 0; i < m_CohortBounds.Count(); i++) {
+			if (bucket < m_CohortBounds[i])
+				return i;
+		}
+
+		return -1;
+	}
+
+	/**
+	    \brief Config effective for a cohort.
+	    \param index Cohort index from GetCohortIndex().
+	    \return Cohort config, or this base config for -1/unknown index.
+	*/
+	Antifreeze_Config GetCohortConfig(int index)
+	{
+		if (index < 0 || index >= m_CohortConfigs.Count())
+			return this;
+
+		return m_CohortConfigs[index];
+	}
+
+	/**
+	    \brief Name of a cohort for metrics.
+	    \param index Cohort index from GetCohortIndex().
+	*/
+	string GetCohortName(int index)
+	{
+		return cohorts[index].name;
+	}
+
 	/**
 	    \brief Randomized jitter for frozen probes.
 	    \return Extra seconds to add to frozenProbeBaseIntervalSeconds.
@@ -240,6 +390,15 @@ class Antifreeze_Config
 		return ttl;
 	}
 
+	/**
+	    \brief Throttle interval stretched for followers.
+	    \return Seconds to keep a follower frozen, always longer than GetThrottleIntervalSeconds().
+	*/
+	float GetFollowerSleepSeconds()
+	{
+		return GetThrottleIntervalSeconds() + followerSleepSeconds;
+	}
+
 	/**
 	    \brief Roll once per zombie to decide whether it should bypass Antifreeze.
 	    \return true if the zombie should run vanilla logic for its lifetime.
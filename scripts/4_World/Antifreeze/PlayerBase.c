@@ -0,0 +1,22 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/antifreeze
+*/
+
+#ifdef SERVER
+modded class PlayerBase
+{
+	/**
+	    \brief Attribute damage from infected to their experiment cohort.
+	*/
+	override void EEHitBy(TotalDamageResult damageResult, int damageType, EntityAI source, int component, string dmgZone, string ammo, vector modelPos, float speedCoef)
+	{
+		super.EEHitBy(damageResult, damageType, source, component, dmgZone, ammo, modelPos, speedCoef);
+
+		ZombieBase zombie;
+		if (damageResult && Class.CastTo(zombie, source))
+			zombie.Antifreeze_OnDamageDealt(damageResult.GetHighestDamage("Health"));
+	}
+}
+#endif
@@ -0,0 +1,300 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/antifreeze
+*/
+
+#ifdef SERVER
+/**
+    \brief ZombieBase::CommandHandler branches counted per frame for spike reports.
+*/
+enum Antifreeze_Branch
+{
+	BYPASS, //!< Disabled, dead or finisher in progress
+	OPT_OUT, //!< Random opt-out actor
+	GRACE, //!< Stimulus grace window
+	FROZEN_WAIT, //!< Frozen, waiting for next probe
+	FROZEN_AGING, //!< Frozen aging tick forwarded to native
+	UNFREEZE, //!< Frozen actor resumed native AI
+	PASS_THRU, //!< Non-MOVE command or no input controller
+	FREEZE_HEIGHT, //!< Frozen by unreachable-by-height gate
+	FREEZE_DENSITY, //!< Frozen by local density culling
+	FOLLOWER_SLEEP, //!< Follower frozen for a stretched throttle interval (with TOKEN_*)
+	FOLLOWER_TICK, //!< Follower holding a token fell through to native logic
+	TOKEN_EXPIRED, //!< Far CHASE token expired
+	TOKEN_DENIED, //!< Far CHASE token roll failed
+	NATIVE, //!< Fell through to native logic
+	COUNT
+}
+
+/**
+    \brief Pursuers of a single target captured in a spike report.
+*/
+class Antifreeze_SpikeTarget
+{
+	string name; //!< Player name or entity type
+	string id; //!< Player plain id, empty for non-players
+	vector position; //!< Target position
+	int pursuers; //!< Living infected chasing this target
+	int active; //!< Pursuers running native AI
+	int frozen; //!< Pursuers with frozen native AI
+	int tokens; //!< Pursuers holding a far CHASE token
+	int followers; //!< Pursuers trailing a same-target leader
+	ref array<vector> positions = new array<vector>(); //!< Pursuer positions (bounded)
+}
+
+/**
+    \brief Snapshot of the infected population on a slow server frame.
+*/
+class Antifreeze_SpikeReport
+{
+	string time; //!< Local wall clock time
+	int missionTimeMs; //!< Mission time in milliseconds
+	float frameMs; //!< Duration of the slow frame
+	int infected; //!< Living tracked infected
+	int active; //!< Infected running native AI
+	int frozen; //!< Infected with frozen native AI
+	int untargeted; //!< Infected without a target
+	ref map<string, int> branches = new map<string, int>(); //!< CommandHandler branches taken during the frame
+	ref array<ref Antifreeze_SpikeTarget> targets = new array<ref Antifreeze_SpikeTarget>(); //!< Busiest targets first
+}
+
+/**
+    \brief Spike log layout written to $profile.
+*/
+class Antifreeze_SpikeLog
+{
+	ref array<ref Antifreeze_SpikeReport> spikes = new array<ref Antifreeze_SpikeReport>();
+}
+
+/**
+    \brief Frame time watchdog: writes rate-limited infected population snapshots on slow frames.
+
+    Branch counters are collected between two mission updates, so they describe
+    the frame whose duration is reported. The log is a bounded ring of reports.
+*/
+class Antifreeze_SpikeMonitor
+{
+	// * Const
+	protected static const string LOG_FILE = "$profile:antifreeze_spikes.json";
+	protected static const float COMPACT_INTERVAL_SECONDS = 30.0;
+
+	// * Singleton
+	ref protected static Antifreeze_SpikeMonitor s_Instance;
+
+	// * Frame counters
+	protected static bool s_Enabled;
+	ref protected static array<int> s_BranchCounts;
+
+	ref protected array<ZombieBase> m_Infected = new array<ZombieBase>(); //!< Weak refs, nulled on delete
+	ref protected Antifreeze_SpikeLog m_Log = new Antifreeze_SpikeLog();
+	protected float m_Cooldown = -1.0;
+	protected float m_CompactAccum;
+
+	/**
+	    \brief Get singleton instance.
+	*/
+	static Antifreeze_SpikeMonitor Get()
+	{
+		if (!s_Instance)
+			s_Instance = new Antifreeze_SpikeMonitor();
+
+		return s_Instance;
+	}
+
+	/**
+	    \brief Count a CommandHandler branch for the current frame.
+	    \param branch Antifreeze_Branch value.
+	*/
+	static void MarkBranch(int branch)
+	{
+		if (!s_Enabled)
+			return;
+
+		s_BranchCounts[branch] = s_BranchCounts[branch] + 1;
+	}
+
+	/**
+	    \brief Track an infected for population snapshots.
+	    \param zombie Newly created infected.
+	*/
+	void Register(ZombieBase zombie)
+	{
+		m_Infected.Insert(zombie);
+	}
+
+	/**
+	    \brief Check frame time, write report on spike and reset frame counters.
+	    \param timeslice Duration of the last frame in seconds.
+	*/
+	void Update(float timeslice)
+	{
+		// Registry is filled regardless of the toggle, keep it compact either way
+		m_CompactAccum += timeslice;
+		if (m_CompactAccum >= COMPACT_INTERVAL_SECONDS) {
+			m_CompactAccum = 0.0;
+			Compact();
+		}
+
+		Antifreeze_Config cfg = Antifreeze_Config.Get();
+		if (!cfg.enableSpikeForensics) {
+			s_Enabled = false;
+			return;
+		}
+
+		if (!s_Enabled) {
+			s_BranchCounts = new array<int>();
+			s_BranchCounts.Resize(Antifreeze_Branch.COUNT);
+			ResetBranchCounts();
+			s_Enabled = true;
+		}
+
+		// Start with a full cooldown to skip mission load frames
+		if (m_Cooldown < 0.0)
+			m_Cooldown = cfg.spikeCooldownSeconds;
+
+		m_Cooldown -= timeslice;
+
+		if (m_Cooldown <= 0.0 && timeslice * 1000.0 >= cfg.spikeFrameThresholdMs) {
+			m_Cooldown = cfg.spikeCooldownSeconds;
+			Capture(cfg, timeslice);
+		}
+
+		ResetBranchCounts();
+	}
+
+	/**
+	    \brief Build a spike report from tracked infected and append it to the log file.
+	    \param cfg Active config.
+	    \param timeslice Duration of the slow frame in seconds.
+	*/
+	protected void Capture(Antifreeze_Config cfg, float timeslice)
+	{
+		Antifreeze_SpikeReport report = new Antifreeze_SpikeReport();
+		report.time = GetTimestamp();
+		report.missionTimeMs = GetGame().GetTime();
+		report.frameMs = timeslice * 1000.0;
+
+		for (int b = 0; b < Antifreeze_Branch.COUNT; b++) {
+			if (s_BranchCounts[b] > 0)
+				report.branches.Insert(typename.EnumToString(Antifreeze_Branch, b), s_BranchCounts[b]);
+		}
+
+		map<EntityAI, ref Antifreeze_SpikeTarget> byTarget = new map<EntityAI, ref Antifreeze_SpikeTarget>();
+		foreach (ZombieBase zombie : m_Infected) {
+			if (!zombie || zombie.IsDamageDestroyed())
+				continue;
+
+			bool frozen = zombie.Antifreeze_IsFrozen();
+			report.infected++;
+			if (frozen)
+				report.frozen++;
+			else
+				report.active++;
+
+			EntityAI target = zombie.Antifreeze_GetTarget();
+			if (!target) {
+				report.untargeted++;
+				continue;
+			}
+
+			Antifreeze_SpikeTarget entry = byTarget.Get(target);
+			if (!entry) {
+				entry = NewTarget(target);
+				byTarget.Insert(target, entry);
+			}
+
+			entry.pursuers++;
+			if (frozen)
+				entry.frozen++;
+			else
+				entry.active++;
+
+			if (zombie.Antifreeze_HasChaseToken())
+				entry.tokens++;
+
+			if (zombie.Antifreeze_IsFollower())
+				entry.followers++;
+
+			if (entry.positions.Count() < cfg.spikeMaxPositionsPerTarget)
+				entry.positions.Insert(zombie.GetPosition());
+		}
+
+		// Keep the busiest targets only
+		array<ref Antifreeze_SpikeTarget> targets = byTarget.GetValueArray();
+		while (report.targets.Count() < cfg.spikeMaxTargets && targets.Count() > 0) {
+			int best = 0;
+			for (int i = 1; i < targets.Count(); i++) {
+				if (targets[i].pursuers > targets[best].pursuers)
+					best = i;
+			}
+
+			report.targets.Insert(targets[best]);
+			targets.Remove(best);
+		}
+
+		m_Log.spikes.Insert(report);
+		while (m_Log.spikes.Count() > cfg.spikeMaxReports)
+			m_Log.spikes.RemoveOrdered(0);
+
+		string error;
+		if (!JsonFileLoader<Antifreeze_SpikeLog>.SaveFile(LOG_FILE, m_Log, error)) {
+			ErrorEx(error);
+			return;
+		}
+
+		ErrorEx(string.Format("AntifreeZe frame spike %1 ms, %2 infected, report saved to %3", report.frameMs, report.infected, LOG_FILE), ErrorExSeverity.INFO);
+	}
+
+	/**
+	    \brief Create a report entry describing a target.
+	    \param target Entity chased by infected.
+	*/
+	protected Antifreeze_SpikeTarget NewTarget(EntityAI target)
+	{
+		Antifreeze_SpikeTarget entry = new Antifreeze_SpikeTarget();
+		entry.position = target.GetPosition();
+		entry.name = target.GetType();
+
+		PlayerBase player = PlayerBase.Cast(target);
+		if (player && player.GetIdentity()) {
+			entry.name = player.GetIdentity().GetName();
+			entry.id = player.GetIdentity().GetPlainId();
+		}
+
+		return entry;
+	}
+
+	/**
+	    \brief Drop references to deleted infected.
+	*/
+	protected void Compact()
+	{
+		for (int i = m_Infected.Count() - 1; i >= 0; i--) {
+			if (!m_Infected[i])
+				m_Infected.Remove(i);
+		}
+	}
+
+	/**
+	    \brief Zero per-frame branch counters.
+	*/
+	protected static void ResetBranchCounts()
+	{
+		for (int i = 0; i < Antifreeze_Branch.COUNT; i++)
+			s_BranchCounts[i] = 0;
+	}
+
+	/**
+	    \brief Local wall clock time as "YYYY-MM-DD hh:mm:ss".
+	*/
+	protected static string GetTimestamp()
+	{
+		int year, month, day, hour, minute, second;
+		GetYearMonthDay(year, month, day);
+		GetHourMinuteSecond(hour, minute, second);
+
+		return string.Format("%1-%2-%3 %4:%5:%6", year, month.ToStringLen(2), day.ToStringLen(2), hour.ToStringLen(2), minute.ToStringLen(2), second.ToStringLen(2));
+	}
+}
+#endif
@@ -12,8 +12,10 @@
     - Freeze native AI (SetKeepInIdle(true)) when target looks "near but unreachable by height".
     - Throttle far CHASE actors via short-lived tokens; keep actors in the active ring responsive.
     - Cull extra actors in dense local clusters to reduce pathing/collision contention.
+    - Cut token budget further for CHASE followers trailing a same-target leader.
     - While frozen, optionally forward rare super() ticks to age native timers/memory.
-    - All thresholds/timings are driven by Antifreeze_Config.
+    - Count branches taken per frame for Antifreeze_SpikeMonitor reports.
+    - All thresholds/timings are driven by Antifreeze_Config, optionally overridden per experiment cohort.
 */
 modded class ZombieBase
 {
@@ -27,6 +29,14 @@ modded class ZombieBase
 	protected float m_Antifreeze_StimulusGrace; //!< No-freeze window after hit/contact
 	protected float m_Antifreeze_HitWakeCD; //!< Min time between wake triggers
 	protected bool m_Antifreeze_OptOut; //!< This zombie runs vanilla if true
+	protected ZombieBase m_Antifreeze_Leader; //!< Same-target neighbor this actor trails (null = leader)
+	protected float m_Antifreeze_LeaderRescanCD; //!< Cooldown until next leader search
+	protected bool m_Antifreeze_FollowerSleeping; //!< Current freeze is a follower sleep window
+	protected int m_Antifreeze_Cohort; //!< Experiment cohort index (-1 = base config)
+	protected int m_Antifreeze_CohortGen; //!< Config generation the cohort was resolved for
+	protected Antifreeze_CohortStats m_Antifreeze_CohortStats; //!< Cohort metrics bucket (null = not tracked)
+	ref protected array<Antifreeze_CohortStats> m_Antifreeze_CohortsJoined; //!< Buckets this actor was counted in
+	protected float m_Antifreeze_ChaseTime; //!< Time spent in current CHASE, for cohort reach metrics
 
 	/**
 	    \brief Constructor: initialize antifreeze state and seed per-entity jitter.
@@ -41,8 +51,16 @@ modded class ZombieBase
 		m_Antifreeze_ChaseTokenTTL = 0.0;
 		m_Antifreeze_StimulusGrace = 0.0;
 		m_Antifreeze_HitWakeCD = 0.0;
+		m_Antifreeze_LeaderRescanCD = 0.0;
+		m_Antifreeze_FollowerSleeping = false;
+		m_Antifreeze_Cohort = -1;
+		m_Antifreeze_CohortGen = -1;
+		m_Antifreeze_ChaseTime = 0.0;
 		m_Antifreeze_RecheckJitter = Antifreeze_Config.Get().GetFrozenProbeJitterSeconds();
 		m_Antifreeze_OptOut = Antifreeze_Config.Get().RollRandomOptOut();
+
+		// Always tracked so forensics enabled by hot reload sees the whole population
+		Antifreeze_SpikeMonitor.Get().Register(this);
 	}
 
 	/**
@@ -53,14 +71,22 @@ modded class ZombieBase
 	*/
 	override void CommandHandler(float pDt, int pCurrentCommandID, bool pCurrentCommandFinished)
 	{
+		// Cohort metrics: measure CHASE -> FIGHT time for every tracked actor
+		if (m_Antifreeze_CohortStats)
+			Antifreeze_TrackCohortReach(pDt);
+
 		// Global bypass: disabled or critical native paths must not be delayed
-		if (!Antifreeze_Config.Get().enableAntifreeze || IsDamageDestroyed() || m_FinisherInProgress) {
+		if (!Antifreeze_Cfg().enableAntifreeze || IsDamageDestroyed() || m_FinisherInProgress) {
+			Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.BYPASS);
+			Antifreeze_CountNativeTick();
 			super.CommandHandler(pDt, pCurrentCommandID, pCurrentCommandFinished);
 			return;
 		}
 
 		// Vanilla roll: skip all antifreeze
 		if (m_Antifreeze_OptOut) {
+			Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.OPT_OUT);
+			Antifreeze_CountNativeTick();
 			super.CommandHandler(pDt, pCurrentCommandID, pCurrentCommandFinished);
 			return;
 		}
@@ -72,6 +98,8 @@ modded class ZombieBase
 		// Stimulus grace: keep AI responsive for a short window
 		if (m_Antifreeze_StimulusGrace > 0.0) {
 			m_Antifreeze_StimulusGrace -= pDt;
+			Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.GRACE);
+			Antifreeze_CountNativeTick();
 			super.CommandHandler(pDt, pCurrentCommandID, pCurrentCommandFinished);
 			return;
 		}
@@ -80,15 +108,17 @@ modded class ZombieBase
 		if (m_Antifreeze_AIFrozen) {
 			m_Antifreeze_UnreachableCD -= pDt;
 
-			if (Antifreeze_Config.Get().enableFrozenAgingTicks) {
+			if (Antifreeze_Cfg().enableFrozenAgingTicks) {
 				m_Antifreeze_AgeAccum += pDt;
-				if (m_Antifreeze_AgeAccum >= Antifreeze_Config.Get().frozenAgingTickInterval) {
+				if (m_Antifreeze_AgeAccum >= Antifreeze_Cfg().frozenAgingTickInterval) {
 					float ageDt = m_Antifreeze_AgeAccum;
-					if (ageDt > Antifreeze_Config.Get().frozenAgingTickDtCap)
-						ageDt = Antifreeze_Config.Get().frozenAgingTickDtCap;
+					if (ageDt > Antifreeze_Cfg().frozenAgingTickDtCap)
+						ageDt = Antifreeze_Cfg().frozenAgingTickDtCap;
 
 					// Temporarily allow native logic to age its timers/memory
 					GetAIAgent().SetKeepInIdle(false);
+					Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.FROZEN_AGING);
+					Antifreeze_CountNativeTick();
 					super.CommandHandler(ageDt, pCurrentCommandID, pCurrentCommandFinished);
 					GetAIAgent().SetKeepInIdle(true);
 
@@ -96,39 +126,54 @@ modded class ZombieBase
 				}
 			}
 
-			if (m_Antifreeze_UnreachableCD <= 0.0) {
+			if (m_Antifreeze_FollowerSleeping && !Antifreeze_HasValidLeader()) {
+				// Leader died or diverged during follower sleep: promote and wake at once
+				m_Antifreeze_FollowerSleeping = false;
+				m_Antifreeze_Leader = null;
+				m_Antifreeze_AIFrozen = false;
+				GetAIAgent().SetKeepInIdle(false);
+				Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.UNFREEZE);
+			} else if (m_Antifreeze_UnreachableCD <= 0.0) {
 				if (Antifreeze_ShouldUnfreezeNow()) {
 					m_Antifreeze_AIFrozen = false;
 					GetAIAgent().SetKeepInIdle(false); // resume native AI
+					Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.UNFREEZE);
 					// fall-through to run super this frame
 				} else {
-					m_Antifreeze_UnreachableCD = Antifreeze_Config.Get().GetThrottleIntervalSeconds();
+					m_Antifreeze_UnreachableCD = Antifreeze_Cfg().GetThrottleIntervalSeconds();
+					Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.FROZEN_WAIT);
 					return; // keep frozen
 				}
 			} else {
+				Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.FROZEN_WAIT);
 				return; // wait until next probe
 			}
 		}
 
 		// Non-MOVE commands: pass-thru
 		if (pCurrentCommandID != DayZInfectedConstants.COMMANDID_MOVE) {
+			Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.PASS_THRU);
+			Antifreeze_CountNativeTick();
 			super.CommandHandler(pDt, pCurrentCommandID, pCurrentCommandFinished);
 			return;
 		}
 
 		DayZInfectedInputController ic = GetInputController();
 		if (!ic) {
+			Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.PASS_THRU);
+			Antifreeze_CountNativeTick();
 			super.CommandHandler(pDt, pCurrentCommandID, pCurrentCommandFinished);
 			return;
 		}
 
 		// Unreachable-by-height gate
-		if (Antifreeze_Config.Get().enableFreezeUnreachableByHeight) {
+		if (Antifreeze_Cfg().enableFreezeUnreachableByHeight) {
 			if (!Antifreeze_IsTargetReachableCheap(ic)) {
 				m_Antifreeze_UnreachableTime += pDt;
 
-				if (m_Antifreeze_UnreachableTime >= Antifreeze_Config.Get().unreachablePersistSeconds) {
-					Antifreeze_FreezeFor(Antifreeze_Config.Get().frozenProbeBaseIntervalSeconds + m_Antifreeze_RecheckJitter);
+				if (m_Antifreeze_UnreachableTime >= Antifreeze_Cfg().unreachablePersistSeconds) {
+					Antifreeze_FreezeFor(Antifreeze_Cfg().frozenProbeBaseIntervalSeconds + m_Antifreeze_RecheckJitter);
+					Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.FREEZE_HEIGHT);
 					return; // drop futile geometry/raycast spam
 				}
 			} else
@@ -136,47 +181,72 @@ modded class ZombieBase
 		}
 
 		// CHASE budget (far actors)
-		if (Antifreeze_Config.Get().enableChaseTokenBudget && ic.GetMindState() == DayZInfectedConstants.MINDSTATE_CHASE) {
+		bool follower = false;
+		if (Antifreeze_Cfg().enableChaseTokenBudget && ic.GetMindState() == DayZInfectedConstants.MINDSTATE_CHASE) {
 			EntityAI tgt = ic.GetTargetEntity();
 			if (tgt) {
 				float dist = vector.Distance(tgt.GetPosition(), GetPosition());
 
 				// Near active ring: keep active to allow smooth transitions into FIGHT
-				if (dist > Antifreeze_Config.Get().activeRingRadiusMeters) {
+				if (dist > Antifreeze_Cfg().activeRingRadiusMeters) {
 
 					// Density culling to mitigate congestion walls
-					if (Antifreeze_Config.Get().enableLocalDensityCulling && Antifreeze_IsLocallyCrowded()) {
-						Antifreeze_FreezeFor(Antifreeze_Config.Get().GetThrottleIntervalSeconds());
+					if (Antifreeze_Cfg().enableLocalDensityCulling && Antifreeze_IsLocallyCrowded()) {
+						Antifreeze_FreezeFor(Antifreeze_Cfg().GetThrottleIntervalSeconds());
+						Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.FREEZE_DENSITY);
 						return;
 					}
 
+					// Follower throttling: further cut on top of the token budget, leader paths for both
+					follower = Antifreeze_Cfg().enableFollowerThrottling && Antifreeze_UpdateLeader(tgt, dist, pDt);
+
 					// Token rotation
 					if (m_Antifreeze_ChaseHasToken) {
+						// Followers never keep a move window longer than followerActiveSeconds
+						if (follower && m_Antifreeze_ChaseTokenTTL > Antifreeze_Cfg().followerActiveSeconds)
+							m_Antifreeze_ChaseTokenTTL = Antifreeze_Cfg().followerActiveSeconds;
+
 						m_Antifreeze_ChaseTokenTTL -= pDt;
 						if (m_Antifreeze_ChaseTokenTTL <= 0.0) {
 							m_Antifreeze_ChaseHasToken = false;
-							Antifreeze_FreezeFor(Antifreeze_Config.Get().GetThrottleIntervalSeconds());
+							Antifreeze_ThrottleFor(follower);
+							Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.TOKEN_EXPIRED);
 							return;
 						}
 
 					} else {
-						if (Math.RandomFloat01() < Antifreeze_Config.Get().GetChaseKeepProbability(dist)) {
+						if (Math.RandomFloat01() < Antifreeze_Cfg().GetChaseKeepProbability(dist)) {
 							m_Antifreeze_ChaseHasToken = true;
-							m_Antifreeze_ChaseTokenTTL = Antifreeze_Config.Get().GetChaseTokenTTLSeconds();
+							m_Antifreeze_ChaseTokenTTL = Antifreeze_Cfg().GetChaseTokenTTLSeconds();
+							if (follower && m_Antifreeze_ChaseTokenTTL > Antifreeze_Cfg().followerActiveSeconds)
+								m_Antifreeze_ChaseTokenTTL = Antifreeze_Cfg().followerActiveSeconds;
 						} else {
-							Antifreeze_FreezeFor(Antifreeze_Config.Get().GetThrottleIntervalSeconds());
+							Antifreeze_ThrottleFor(follower);
+							Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.TOKEN_DENIED);
 							return;
 						}
 					}
 
-				} else
-					Antifreeze_ResetChaseToken(); // Inside the active ring: clear token to avoid monopolies
+				} else {
+					// Inside the active ring: clear token to avoid monopolies
+					Antifreeze_ResetChaseToken();
+					Antifreeze_ResetLeader();
+				}
 			}
 
-		} else
-			Antifreeze_ResetChaseToken(); // Not in CHASE: ensure token cleared
+		} else {
+			// Not in CHASE: ensure token and leader link cleared
+			Antifreeze_ResetChaseToken();
+			Antifreeze_ResetLeader();
+		}
 
 		// Fallthrough to native logic
+		if (follower)
+			Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.FOLLOWER_TICK);
+		else
+			Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.NATIVE);
+
+		Antifreeze_CountNativeTick();
 		super.CommandHandler(pDt, pCurrentCommandID, pCurrentCommandFinished);
 	}
 
@@ -190,8 +260,8 @@ modded class ZombieBase
 		if (m_Antifreeze_HitWakeCD > 0.0)
 			return;
 
-		Antifreeze_WakeFor(Antifreeze_Config.Get().wakeGraceSeconds);
-		m_Antifreeze_HitWakeCD = Antifreeze_Config.Get().wakeCooldownSeconds;
+		Antifreeze_WakeFor(Antifreeze_Cfg().wakeGraceSeconds);
+		m_Antifreeze_HitWakeCD = Antifreeze_Cfg().wakeCooldownSeconds;
 	}
 
 	/**
@@ -204,8 +274,8 @@ modded class ZombieBase
 		if (m_Antifreeze_HitWakeCD > 0.0)
 			return;
 
-		Antifreeze_WakeFor(Antifreeze_Config.Get().wakeGraceSeconds);
-		m_Antifreeze_HitWakeCD = Antifreeze_Config.Get().wakeCooldownSeconds;
+		Antifreeze_WakeFor(Antifreeze_Cfg().wakeGraceSeconds);
+		m_Antifreeze_HitWakeCD = Antifreeze_Cfg().wakeCooldownSeconds;
 	}
 
 	/**
@@ -221,8 +291,8 @@ modded class ZombieBase
 		if (GetAIAgent())
 			GetAIAgent().SetKeepInIdle(true);
 
-		if (Antifreeze_Config.Get().enableForceCleanupBodies)
-			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(this.Delete, Antifreeze_Config.Get().cleanupBodiesTTL * 1000, false, true);
+		if (Antifreeze_Cfg().enableForceCleanupBodies)
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(this.Delete, Antifreeze_Cfg().cleanupBodiesTTL * 1000, false, true);
 
 		// I'm not sure if this helps, but I'll try.
 		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(this.DisableSimulation, 1500, false, true);
@@ -230,6 +300,104 @@ modded class ZombieBase
 
 	// --------------------- helpers ---------------------
 
+	/**
+	    \brief Effective config for this actor: base config or its experiment cohort.
+
+	    Cohort is assigned deterministically from the entity id and re-resolved
+	    after every config (re)load.
+	*/
+	protected Antifreeze_Config Antifreeze_Cfg()
+	{
+		Antifreeze_Config cfg = Antifreeze_Config.Get();
+		if (m_Antifreeze_CohortGen != Antifreeze_Config.GetGeneration())
+			Antifreeze_AssignCohort(cfg);
+
+		return cfg.GetCohortConfig(m_Antifreeze_Cohort);
+	}
+
+	/**
+	    \brief Resolve cohort index and metrics bucket for the current config generation.
+
+	    An actor is counted once per cohort it ever joins and never subtracted,
+	    so actors stays consistent with the cumulative counters it contributed to.
+
+	    \param cfg Base config.
+	*/
+	protected void Antifreeze_AssignCohort(Antifreeze_Config cfg)
+	{
+		m_Antifreeze_CohortGen = Antifreeze_Config.GetGeneration();
+		m_Antifreeze_Cohort = -1;
+
+		// Random opt-out actors are vanilla outside of any experiment
+		if (!m_Antifreeze_OptOut)
+			m_Antifreeze_Cohort = cfg.GetCohortIndex(GetID());
+
+		// Now vanilla (control cohort or master switch off): the bypass branch never unfreezes
+		if (!cfg.GetCohortConfig(m_Antifreeze_Cohort).enableAntifreeze && !IsDamageDestroyed())
+			Antifreeze_Release();
+
+		Antifreeze_CohortStats stats;
+		if (m_Antifreeze_Cohort >= 0)
+			stats = Antifreeze_CohortMetrics.Get().GetStats(cfg.GetCohortName(m_Antifreeze_Cohort));
+
+		if (stats == m_Antifreeze_CohortStats)
+			return;
+
+		if (stats) {
+			if (!m_Antifreeze_CohortsJoined)
+				m_Antifreeze_CohortsJoined = new array<Antifreeze_CohortStats>();
+
+			if (m_Antifreeze_CohortsJoined.Find(stats) < 0) {
+				m_Antifreeze_CohortsJoined.Insert(stats);
+				stats.actors++;
+			}
+		}
+
+		m_Antifreeze_CohortStats = stats;
+		m_Antifreeze_ChaseTime = 0.0;
+	}
+
+	/**
+	    \brief Count a native CommandHandler tick for cohort metrics.
+	*/
+	protected void Antifreeze_CountNativeTick()
+	{
+		if (m_Antifreeze_CohortStats)
+			m_Antifreeze_CohortStats.nativeTicks++;
+	}
+
+	/**
+	    \brief Accumulate CHASE time and record it when the actor reaches FIGHT.
+	    \param pDt Frame delta time.
+	*/
+	protected void Antifreeze_TrackCohortReach(float pDt)
+	{
+		DayZInfectedInputController ic = GetInputController();
+		if (!ic)
+			return;
+
+		int mind = ic.GetMindState();
+		if (mind == DayZInfectedConstants.MINDSTATE_CHASE) {
+			m_Antifreeze_ChaseTime += pDt;
+			return;
+		}
+
+		if (mind == DayZInfectedConstants.MINDSTATE_FIGHT && m_Antifreeze_ChaseTime > 0.0)
+			m_Antifreeze_CohortStats.AddReach(m_Antifreeze_ChaseTime);
+
+		m_Antifreeze_ChaseTime = 0.0;
+	}
+
+	/**
+	    \brief Add damage dealt by this actor to its cohort metrics.
+	    \param damage Health damage applied to the victim.
+	*/
+	void Antifreeze_OnDamageDealt(float damage)
+	{
+		if (m_Antifreeze_CohortStats)
+			m_Antifreeze_CohortStats.damageDealt += damage;
+	}
+
 	/**
 	    \brief Freeze native AI for a given window.
 	    \param seconds Duration before next unfreeze probe.
@@ -238,7 +406,43 @@ modded class ZombieBase
 	{
 		m_Antifreeze_AIFrozen = true;
 		m_Antifreeze_UnreachableCD = seconds;
+		m_Antifreeze_FollowerSleeping = false;
 		GetAIAgent().SetKeepInIdle(true);
+
+		if (m_Antifreeze_CohortStats)
+			m_Antifreeze_CohortStats.freezes++;
+	}
+
+	/**
+	    \brief Freeze a far CHASE actor that is not allowed to move this turn.
+	    \param follower Whether the actor trails a leader (gets a stretched sleep).
+	*/
+	protected void Antifreeze_ThrottleFor(bool follower)
+	{
+		if (!follower) {
+			Antifreeze_FreezeFor(Antifreeze_Cfg().GetThrottleIntervalSeconds());
+			return;
+		}
+
+		Antifreeze_FreezeFor(Antifreeze_Cfg().GetFollowerSleepSeconds());
+		m_Antifreeze_FollowerSleeping = true;
+		Antifreeze_SpikeMonitor.MarkBranch(Antifreeze_Branch.FOLLOWER_SLEEP);
+	}
+
+	/**
+	    \brief Drop every antifreeze hold so the actor runs pure native AI.
+	*/
+	protected void Antifreeze_Release()
+	{
+		if (m_Antifreeze_AIFrozen) {
+			m_Antifreeze_AIFrozen = false;
+			if (GetAIAgent())
+				GetAIAgent().SetKeepInIdle(false);
+		}
+
+		m_Antifreeze_FollowerSleeping = false;
+		Antifreeze_ResetChaseToken();
+		Antifreeze_ResetLeader();
 	}
 
 	/**
@@ -256,6 +460,7 @@ modded class ZombieBase
 		// Reset freeze accumulators
 		m_Antifreeze_UnreachableTime = 0.0;
 		m_Antifreeze_UnreachableCD = 0.0;
+		m_Antifreeze_FollowerSleeping = false;
 
 		// Extend grace
 		if (seconds > m_Antifreeze_StimulusGrace)
@@ -279,7 +484,7 @@ modded class ZombieBase
 		float dist = vector.Distance(target.GetPosition(), GetPosition());
 
 		// Inside active ring: always unfreeze to stay responsive
-		if (dist <= Antifreeze_Config.Get().activeRingRadiusMeters)
+		if (dist <= Antifreeze_Cfg().activeRingRadiusMeters)
 			return true;
 
 		// Outside: only unfreeze if we can actually attack target position
@@ -310,11 +515,11 @@ modded class ZombieBase
 		float r2 = dx * dx + dz * dz;
 
 		// Close and target is above by threshold → treat as unreachable
-		if (r2 <= Antifreeze_Config.Get().nearRadiusSquared && dy > Antifreeze_Config.Get().unreachableHeightDeltaMeters)
+		if (r2 <= Antifreeze_Cfg().nearRadiusSquared && dy > Antifreeze_Cfg().unreachableHeightDeltaMeters)
 			return false;
 
 		// Optional single native probe; cheaper than full fight logic storm
-		if (Antifreeze_Config.Get().enableCheapAttackProbe && !CanAttackToPosition(tp))
+		if (Antifreeze_Cfg().enableCheapAttackProbe && !CanAttackToPosition(tp))
 			return false;
 
 		return true;
@@ -326,7 +531,7 @@ modded class ZombieBase
 	*/
 	protected bool Antifreeze_IsLocallyCrowded()
 	{
-		float r = Antifreeze_Config.Get().densityWindowRadiusMeters;
+		float r = Antifreeze_Cfg().densityWindowRadiusMeters;
 		vector pos = GetPosition();
 		vector mn = Vector(pos[0] - r, pos[1] - 1.0, pos[2] - r);
 		vector mx = Vector(pos[0] + r, pos[1] + 1.0, pos[2] + r);
@@ -340,7 +545,7 @@ modded class ZombieBase
 			if (Class.CastTo(zombie, eai) && zombie != this && !zombie.IsDamageDestroyed())
 				cnt++;
 
-			if (cnt >= Antifreeze_Config.Get().densityMaxNeighbors)
+			if (cnt >= Antifreeze_Cfg().densityMaxNeighbors)
 				return true;
 		}
 		return false;
@@ -359,5 +564,140 @@ modded class ZombieBase
 		m_Antifreeze_ChaseHasToken = false;
 		m_Antifreeze_ChaseTokenTTL = 0.0;
 	}
+
+	/**
+	    \brief Whether native AI is currently frozen.
+	*/
+	bool Antifreeze_IsFrozen()
+	{
+		return m_Antifreeze_AIFrozen;
+	}
+
+	/**
+	    \brief Whether this actor holds a far CHASE token.
+	*/
+	bool Antifreeze_HasChaseToken()
+	{
+		return m_Antifreeze_ChaseHasToken;
+	}
+
+	/**
+	    \brief Whether this actor trails a same-target leader.
+	*/
+	bool Antifreeze_IsFollower()
+	{
+		return m_Antifreeze_Leader != null;
+	}
+
+	/**
+	    \brief Current CHASE target of this actor.
+	    \return Target entity or null if none/no controller.
+	*/
+	EntityAI Antifreeze_GetTarget()
+	{
+		DayZInfectedInputController ic = GetInputController();
+		if (!ic)
+			return null;
+
+		return ic.GetTargetEntity();
+	}
+
+	/**
+	    \brief Keep the leader link valid and search for a new leader on cooldown.
+
+	    A leader is a living neighbor with the same target that is closer to it
+	    and within followerLinkRadiusMeters. Chains form naturally (a leader may
+	    follow its own leader), so only the head of each group runs the regular
+	    token budget while the rest get shorter move windows and longer sleeps.
+	    Dead or diverged leaders are dropped, promoting this actor; while the
+	    follower sleeps the frozen branch checks its leader every frame.
+
+	    \param target Current CHASE target.
+	    \param dist Current distance to target in meters.
+	    \param pDt Frame delta time.
+	    \return true if this actor is a follower this frame.
+	*/
+	protected bool Antifreeze_UpdateLeader(EntityAI target, float dist, float pDt)
+	{
+		if (m_Antifreeze_Leader && Antifreeze_IsLeaderFor(m_Antifreeze_Leader, target, dist))
+			return true;
+
+		// Leader lost or never assigned: act as a leader until the next search
+		m_Antifreeze_Leader = null;
+
+		m_Antifreeze_LeaderRescanCD -= pDt;
+		if (m_Antifreeze_LeaderRescanCD > 0.0)
+			return false;
+
+		m_Antifreeze_LeaderRescanCD = Antifreeze_Cfg().followerRescanSeconds;
+
+		float r = Antifreeze_Cfg().followerLinkRadiusMeters;
+		vector pos = GetPosition();
+		vector mn = Vector(pos[0] - r, pos[1] - 1.0, pos[2] - r);
+		vector mx = Vector(pos[0] + r, pos[1] + 1.0, pos[2] + r);
+
+		array<EntityAI> entities = new array<EntityAI>();
+		DayZPlayerUtils.SceneGetEntitiesInBox(mn, mx, entities, QueryFlags.DYNAMIC);
+
+		vector tp = target.GetPosition();
+		float bestDist = dist;
+		foreach (EntityAI eai : entities) {
+			ZombieBase zombie;
+			if (!Class.CastTo(zombie, eai) || zombie == this || !Antifreeze_IsLeaderFor(zombie, target, dist))
+				continue;
+
+			// Prefer the neighbor nearest to the target to keep chains short
+			float d = vector.Distance(tp, zombie.GetPosition());
+			if (d < bestDist) {
+				bestDist = d;
+				m_Antifreeze_Leader = zombie;
+			}
+		}
+
+		return m_Antifreeze_Leader != null;
+	}
+
+	/**
+	    \brief Revalidate the current leader against this actor's target.
+	    \return true if a leader is set and still leads this actor.
+	*/
+	protected bool Antifreeze_HasValidLeader()
+	{
+		if (!m_Antifreeze_Leader)
+			return false;
+
+		EntityAI target = Antifreeze_GetTarget();
+		if (!target)
+			return false;
+
+		return Antifreeze_IsLeaderFor(m_Antifreeze_Leader, target, vector.Distance(target.GetPosition(), GetPosition()));
+	}
+
+	/**
+	    \brief Check whether a neighbor can lead this actor toward the target.
+	    \param leader Candidate leader.
+	    \param target Current CHASE target.
+	    \param dist Current distance to target in meters.
+	    \return true if leader is alive, chases the same target, is closer to it and within link radius.
+	*/
+	protected bool Antifreeze_IsLeaderFor(ZombieBase leader, EntityAI target, float dist)
+	{
+		if (leader.IsDamageDestroyed() || leader.Antifreeze_GetTarget() != target)
+			return false;
+
+		float r = Antifreeze_Cfg().followerLinkRadiusMeters;
+		if (vector.DistanceSq(leader.GetPosition(), GetPosition()) > r * r)
+			return false;
+
+		return vector.Distance(target.GetPosition(), leader.GetPosition()) < dist;
+	}
+
+	/**
+	    \brief Drop leader link (actor runs as a leader).
+	*/
+	protected void Antifreeze_ResetLeader()
+	{
+		m_Antifreeze_Leader = null;
+	}
 }
 #endif
@@ -23,5 +23,30 @@ modded class MissionServer : MissionBase
 
 		super.OnEvent(eventTypeId, params);
 	}
+
+	/**
+	    \brief Drive periodic cohort metrics report and frame spike watchdog.
+	*/
+	override void OnUpdate(float timeslice)
+	{
+		super.OnUpdate(timeslice);
+
+		if (Antifreeze_Config.Get().enableCohorts)
+			Antifreeze_CohortMetrics.Get().Update(timeslice);
+
+		// Always ticked: resets per-frame branch counters and handles toggling off
+		Antifreeze_SpikeMonitor.Get().Update(timeslice);
+	}
+
+	/**
+	    \brief Write final cohort metrics report on shutdown.
+	*/
+	override void OnMissionFinish()
+	{
+		if (Antifreeze_Config.Get().enableCohorts)
+			Antifreeze_CohortMetrics.Get().Flush();
+
+		super.OnMissionFinish();
+	}
 }
 #endif